@@ -153,6 +153,8 @@ FunctionDefinition const* ContractDefinition::receiveFunction() const
 
 vector<EventDefinition const*> const& ContractDefinition::interfaceEvents() const
 {
+	// Computing the events needs types, so acquire the type lock first to keep the lock order.
+	lock_guard<recursive_mutex> lock(TypeProvider::mutex());
 	return m_interfaceEvents.init([&]{
 		set<string> eventsSeen;
 		vector<EventDefinition const*> interfaceEvents;
@@ -179,6 +181,8 @@ vector<EventDefinition const*> const& ContractDefinition::interfaceEvents() cons
 
 vector<pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractDefinition::interfaceFunctionList(bool _includeInheritedFunctions) const
 {
+	// Computing the functions needs types, so acquire the type lock first to keep the lock order.
+	lock_guard<recursive_mutex> lock(TypeProvider::mutex());
 	return m_interfaceFunctionList[_includeInheritedFunctions].init([&]{
 		set<string> signaturesSeen;
 		vector<pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
@@ -247,11 +247,17 @@ vector<frontend::Type const*> solidity::frontend::oversizedSubtypes(frontend::Ty
 	return res;
 }
 
+Type::~Type()
+{
+	delete m_members.load();
+}
+
 void Type::clearCache() const
 {
-	m_members.clear();
+	delete m_members.exchange(nullptr);
 	m_stackItems.reset();
-	m_stackSize.reset();
+	m_stackItemsInitialized = false;
+	m_stackSize = 0;
 }
 
 void StorageOffsets::computeOffsets(TypePointers const& _types)
@@ -317,6 +323,7 @@ u256 const& MemberList::storageSize() const
 }
 
 StorageOffsets const& MemberList::storageOffsets() const {
+	lock_guard<recursive_mutex> lock(TypeProvider::mutex());
 	return m_storageOffsets.init([&]{
 		TypePointers memberTypes;
 		memberTypes.reserve(m_memberTypes.size());
@@ -409,21 +416,66 @@ TypePointer Type::commonType(Type const* _a, Type const* _b)
 		return nullptr;
 }
 
-MemberList const& Type::members(ASTNode const* _currentScope) const
+vector<tuple<string, TypePointer>> const& Type::stackItems() const
 {
-	if (!m_members[_currentScope])
+	// Types are shared between concurrently compiled contracts, so the stack items are
+	// computed without holding a lock and only published under the lock.
+	if (!m_stackItemsInitialized.load(memory_order_acquire))
 	{
-		solAssert(
-			_currentScope == nullptr ||
-			dynamic_cast<SourceUnit const*>(_currentScope) ||
-			dynamic_cast<ContractDefinition const*>(_currentScope),
-		"");
-		MemberList::MemberMap members = nativeMembers(_currentScope);
-		if (_currentScope)
-			members += boundFunctions(*this, *_currentScope);
-		m_members[_currentScope] = make_unique<MemberList>(move(members));
+		vector<tuple<string, TypePointer>> stackItems = makeStackItems();
+		lock_guard<recursive_mutex> lock(TypeProvider::mutex());
+		if (!m_stackItems)
+		{
+			m_stackItems = move(stackItems);
+			m_stackItemsInitialized.store(true, memory_order_release);
+		}
 	}
-	return *m_members[_currentScope];
+	return *m_stackItems;
+}
+
+unsigned Type::sizeOnStack() const
+{
+	size_t stackSize = m_stackSize.load(memory_order_relaxed);
+	if (stackSize == 0)
+	{
+		for (auto const& slot: stackItems())
+			if (get<1>(slot))
+				stackSize += get<1>(slot)->sizeOnStack();
+			else
+				++stackSize;
+		// The size does not depend on the thread computing it, so any store wins.
+		m_stackSize.store(stackSize + 1, memory_order_relaxed);
+		return static_cast<unsigned>(stackSize);
+	}
+	return static_cast<unsigned>(stackSize - 1);
+}
+
+MemberList const& Type::members(ASTNode const* _currentScope) const
+{
+	for (ScopedMemberList const* list = m_members.load(memory_order_acquire); list; list = list->next.get())
+		if (list->scope == _currentScope)
+			return *list->members;
+
+	solAssert(
+		_currentScope == nullptr ||
+		dynamic_cast<SourceUnit const*>(_currentScope) ||
+		dynamic_cast<ContractDefinition const*>(_currentScope),
+	"");
+	MemberList::MemberMap members = nativeMembers(_currentScope);
+	if (_currentScope)
+		members += boundFunctions(*this, *_currentScope);
+
+	lock_guard<recursive_mutex> lock(TypeProvider::mutex());
+	// Another thread may have computed the members in the meantime.
+	for (ScopedMemberList const* list = m_members.load(memory_order_acquire); list; list = list->next.get())
+		if (list->scope == _currentScope)
+			return *list->members;
+	auto list = make_unique<ScopedMemberList>();
+	list->scope = _currentScope;
+	list->members = make_unique<MemberList>(move(members));
+	list->next.reset(m_members.load(memory_order_relaxed));
+	m_members.store(list.get(), memory_order_release);
+	return *list.release()->members;
 }
 
 TypePointer Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) const
@@ -2029,6 +2081,7 @@ TypePointer ArrayType::decodingType() const
 
 TypeResult ArrayType::interfaceType(bool _inLibrary) const
 {
+	lock_guard<recursive_mutex> lock(TypeProvider::mutex());
 	if (_inLibrary && m_interfaceType_library.has_value())
 		return *m_interfaceType_library;
 
@@ -2195,6 +2248,7 @@ MemberList::MemberMap ContractType::nativeMembers(ASTNode const*) const
 
 FunctionType const* ContractType::newExpressionType() const
 {
+	lock_guard<recursive_mutex> lock(TypeProvider::mutex());
 	if (!m_constructorType)
 		m_constructorType = FunctionType::newExpressionType(m_contract);
 	return m_constructorType;
@@ -2382,6 +2436,7 @@ MemberList::MemberMap StructType::nativeMembers(ASTNode const*) const
 
 TypeResult StructType::interfaceType(bool _inLibrary) const
 {
+	lock_guard<recursive_mutex> lock(TypeProvider::mutex());
 	if (!_inLibrary)
 	{
 		if (!m_interfaceType.has_value())
@@ -34,6 +34,7 @@
 
 #include <boost/rational.hpp>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <optional>
@@ -167,7 +168,7 @@ public:
 	Type(Type&&) = delete;
 	Type& operator=(Type const&) = delete;
 	Type& operator=(Type&&) = delete;
-	virtual ~Type() = default;
+	virtual ~Type();
 
 	enum class Category
 	{
@@ -281,27 +282,9 @@ public:
 	/// The complete layout of a type on the stack can be obtained from its stack items recursively as follows:
 	/// - Each unnamed stack item is untyped (its type is ``nullptr``) and contributes exactly one stack slot.
 	/// - Each named stack item is typed and contributes the stack slots given by the stack items of its type.
-	std::vector<std::tuple<std::string, TypePointer>> const& stackItems() const
-	{
-		if (!m_stackItems)
-			m_stackItems = makeStackItems();
-		return *m_stackItems;
-	}
+	std::vector<std::tuple<std::string, TypePointer>> const& stackItems() const;
 	/// Total number of stack slots occupied by this type. This is the sum of ``sizeOnStack`` of all ``stackItems()``.
-	unsigned sizeOnStack() const
-	{
-		if (!m_stackSize)
-		{
-			size_t sizeOnStack = 0;
-			for (auto const& slot: stackItems())
-				if (std::get<1>(slot))
-					sizeOnStack += std::get<1>(slot)->sizeOnStack();
-				else
-					++sizeOnStack;
-			m_stackSize = sizeOnStack;
-		}
-		return *m_stackSize;
-	}
+	unsigned sizeOnStack() const;
 	/// If it is possible to initialize such a value in memory by just writing zeros
 	/// of the size memoryHeadSize().
 	virtual bool hasSimpleZeroValueInMemory() const { return true; }
@@ -386,10 +369,22 @@ protected:
 	}
 
 
+	/// Member list for a single scope. The member lists of a type form a singly linked list
+	/// that is only ever prepended to, so that lookups do not need to lock.
+	struct ScopedMemberList
+	{
+		ASTNode const* scope = nullptr;
+		std::unique_ptr<MemberList> members;
+		std::unique_ptr<ScopedMemberList> next;
+	};
+
 	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
+	/// Owns the head of the list.
+	mutable std::atomic<ScopedMemberList*> m_members{nullptr};
 	mutable std::optional<std::vector<std::tuple<std::string, TypePointer>>> m_stackItems;
-	mutable std::optional<size_t> m_stackSize;
+	mutable std::atomic<bool> m_stackItemsInitialized{false};
+	/// Zero if not yet computed, the stack size plus one otherwise.
+	mutable std::atomic<size_t> m_stackSize{0};
 };
 
 /**
@@ -39,6 +39,7 @@
 #include <libsolidity/analysis/ImmutableValidator.h>
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/ast/ASTJsonImporter.h>
 #include <libsolidity/codegen/Compiler.h>
@@ -64,10 +65,14 @@
 #include <libsolutil/SwarmHash.h>
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/ThreadPool.h>
 
 #include <json/json.h>
 
 #include <boost/algorithm/string/replace.hpp>
+
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 using namespace std;
@@ -172,6 +177,14 @@ void CompilerStack::setRevertStringBehaviour(RevertStrings _revertStrings)
 	m_revertStrings = _revertStrings;
 }
 
+void CompilerStack::setParallelism(unsigned _jobs)
+{
+	if (m_stackState >= CompilationSuccessful)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set parallelism before compiling."));
+	solAssert(_jobs > 0, "At least one job is required.");
+	m_parallelism = _jobs;
+}
+
 void CompilerStack::useMetadataLiteralSources(bool _metadataLiteralSources)
 {
 	if (m_stackState >= ParsingPerformed)
@@ -208,6 +221,7 @@ void CompilerStack::reset(bool _keepSettings)
 		m_enabledSMTSolvers = smtutil::SMTSolverChoice::All();
 		m_generateIR = false;
 		m_generateEwasm = false;
+		m_parallelism = 1;
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -502,18 +516,28 @@ bool CompilerStack::compile()
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
 
 	// Only compile contracts individually which have been requested.
-	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	vector<ContractDefinition const*> requestedContracts;
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
 				if (isRequestedContract(*contract))
-				{
-					compileContract(*contract, otherCompilers);
-					if (m_generateIR || m_generateEwasm)
-						generateIR(*contract);
-					if (m_generateEwasm)
-						generateEwasm(*contract);
-				}
+					requestedContracts.push_back(contract);
+
+	if (m_parallelism > 1)
+		compileContractsConcurrently(requestedContracts);
+	else
+	{
+		map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+		for (ContractDefinition const* contract: requestedContracts)
+		{
+			compileContract(*contract, otherCompilers);
+			if (m_generateIR || m_generateEwasm)
+				generateIR(*contract);
+			if (m_generateEwasm)
+				generateEwasm(*contract);
+		}
+	}
+
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -1024,6 +1048,253 @@ bool onlySafeExperimentalFeaturesActivated(set<ExperimentalFeature> const& featu
 			return false;
 	return true;
 }
+
+/// Creates the annotations of all visited nodes. Annotations are created on first access,
+/// which must not happen concurrently.
+class AnnotationInitializer: public ASTConstVisitor
+{
+private:
+	bool visitNode(ASTNode const& _node) override
+	{
+		_node.annotation();
+		return true;
+	}
+};
+
+/// Collects the contracts whose code is embedded into a contract by the legacy code generator,
+/// i.e. contracts that are created via ``new`` or whose code is accessed via ``type(C)``.
+/// Internal library functions are compiled into the calling contract, so the libraries
+/// whose functions are referenced are searched as well.
+class EmbeddedContractsCollector: public ASTConstVisitor
+{
+public:
+	explicit EmbeddedContractsCollector(ContractDefinition const& _contract)
+	{
+		for (ContractDefinition const* base: _contract.annotation().linearizedBaseContracts)
+			base->accept(*this);
+		while (!m_librariesToVisit.empty())
+		{
+			ContractDefinition const* library = m_librariesToVisit.back();
+			m_librariesToVisit.pop_back();
+			library->accept(*this);
+		}
+	}
+
+	set<ContractDefinition const*> const& contracts() const { return m_contracts; }
+
+private:
+	void endVisit(NewExpression const& _newExpression) override
+	{
+		if (auto contractType = dynamic_cast<ContractType const*>(_newExpression.typeName().annotation().type))
+			m_contracts.insert(&contractType->contractDefinition());
+	}
+
+	void endVisit(Identifier const& _identifier) override
+	{
+		visitLibraryOf(_identifier.annotation().referencedDeclaration);
+	}
+
+	void endVisit(MemberAccess const& _memberAccess) override
+	{
+		visitLibraryOf(_memberAccess.annotation().referencedDeclaration);
+		if (_memberAccess.memberName() != "creationCode" && _memberAccess.memberName() != "runtimeCode")
+			return;
+		if (auto magicType = dynamic_cast<MagicType const*>(_memberAccess.expression().annotation().type))
+			if (magicType->kind() == MagicType::Kind::MetaType)
+				if (auto contractType = dynamic_cast<ContractType const*>(magicType->typeArgument()))
+					m_contracts.insert(&contractType->contractDefinition());
+	}
+
+	void visitLibraryOf(Declaration const* _declaration)
+	{
+		if (!dynamic_cast<FunctionDefinition const*>(_declaration))
+			return;
+		if (auto library = dynamic_cast<ContractDefinition const*>(_declaration->scope()))
+			if (library->isLibrary() && m_visitedLibraries.insert(library).second)
+				m_librariesToVisit.push_back(library);
+	}
+
+	set<ContractDefinition const*> m_contracts;
+	set<ContractDefinition const*> m_visitedLibraries;
+	vector<ContractDefinition const*> m_librariesToVisit;
+};
+}
+
+vector<ContractDefinition const*> CompilerStack::compilationOrder(
+	vector<ContractDefinition const*> const& _requestedContracts
+) const
+{
+	vector<ContractDefinition const*> order;
+	set<ContractDefinition const*> visited;
+	std::function<void(ContractDefinition const*)> visit = [&](ContractDefinition const* _contract)
+	{
+		if (!visited.insert(_contract).second)
+			return;
+		// Mirrors compileContract, which does not descend into contracts that cannot be deployed.
+		if (_contract->canBeDeployed())
+			for (ContractDefinition const* dependency: _contract->annotation().contractDependencies)
+				if (dependency->canBeDeployed())
+					visit(dependency);
+		order.push_back(_contract);
+	};
+	for (ContractDefinition const* contract: _requestedContracts)
+		visit(contract);
+	return order;
+}
+
+void CompilerStack::compileContractsConcurrently(vector<ContractDefinition const*> const& _requestedContracts)
+{
+	solAssert(m_stackState >= AnalysisPerformed, "");
+	if (m_hasError)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
+
+	vector<ContractDefinition const*> order = compilationOrder(_requestedContracts);
+	set<ContractDefinition const*> requested(_requestedContracts.begin(), _requestedContracts.end());
+	map<ContractDefinition const*, size_t> position;
+	for (size_t i = 0; i < order.size(); ++i)
+		position[order[i]] = i;
+
+	// State that is computed lazily by the compilation of a contract must be created up front.
+	AnnotationInitializer annotationInitializer;
+	for (Source const* source: m_sourceOrder)
+		source->ast->accept(annotationInitializer);
+	for (ContractDefinition const* contract: order)
+		if (contract->canBeDeployed())
+			metadata(m_contracts.at(contract->fullyQualifiedName()));
+
+	// Build the dependency graph. Embedded contracts have to be compiled first, if a serial
+	// compilation would have compiled them first. Optimising a contract also optimises the
+	// assemblies of all contracts embedded into it, so contracts sharing an embedded contract
+	// are chained in the serial order.
+	map<ContractDefinition const*, set<ContractDefinition const*>> dependencies;
+	map<ContractDefinition const*, set<ContractDefinition const*>> embeddedContracts;
+	map<ContractDefinition const*, ContractDefinition const*> lastEmbeddingContract;
+	for (ContractDefinition const* contract: order)
+	{
+		if (!contract->canBeDeployed())
+		{
+			dependencies[contract];
+			continue;
+		}
+		for (ContractDefinition const* dependency: contract->annotation().contractDependencies)
+			if (dependency->canBeDeployed())
+				dependencies[contract].insert(dependency);
+
+		set<ContractDefinition const*>& embedded = embeddedContracts[contract];
+		EmbeddedContractsCollector collector(*contract);
+		for (ContractDefinition const* embeddedContract: collector.contracts())
+		{
+			embedded.insert(embeddedContract);
+			if (embeddedContracts.count(embeddedContract))
+				embedded += embeddedContracts.at(embeddedContract);
+		}
+		for (ContractDefinition const* embeddedContract: embedded)
+		{
+			if (position.count(embeddedContract) && position.at(embeddedContract) < position.at(contract))
+				dependencies[contract].insert(embeddedContract);
+			if (lastEmbeddingContract.count(embeddedContract))
+				dependencies[contract].insert(lastEmbeddingContract.at(embeddedContract));
+			lastEmbeddingContract[embeddedContract] = contract;
+		}
+	}
+
+	map<ContractDefinition const*, vector<ContractDefinition const*>> dependents;
+	for (auto const& [contract, contractDependencies]: dependencies)
+		for (ContractDefinition const* dependency: contractDependencies)
+			dependents[dependency].push_back(contract);
+
+	mutex resultsMutex;
+	condition_variable finishedCondition;
+	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	vector<ContractDefinition const*> finished;
+	map<ContractDefinition const*, exception_ptr> failures;
+
+	m_compilingConcurrently = true;
+	util::ThreadPool pool(m_parallelism);
+	auto schedule = [&](ContractDefinition const* _contract)
+	{
+		pool.submit([&, _contract]()
+		{
+			exception_ptr failure;
+			try
+			{
+				// Only provide what a serial compilation would have compiled so far.
+				map<ContractDefinition const*, shared_ptr<Compiler const>> compilers;
+				{
+					lock_guard<mutex> lock(resultsMutex);
+					for (auto const& [contract, compiler]: otherCompilers)
+						if (position.at(contract) < position.at(_contract))
+							compilers[contract] = compiler;
+				}
+				compileContract(*_contract, compilers);
+				if (m_generateIR || m_generateEwasm)
+					generateIR(*_contract);
+				if (m_generateEwasm && requested.count(_contract))
+					generateEwasm(*_contract);
+				if (compilers.count(_contract))
+				{
+					lock_guard<mutex> lock(resultsMutex);
+					otherCompilers[_contract] = compilers.at(_contract);
+				}
+			}
+			catch (...)
+			{
+				failure = current_exception();
+			}
+
+			{
+				lock_guard<mutex> lock(resultsMutex);
+				if (failure)
+					failures[_contract] = failure;
+				finished.push_back(_contract);
+			}
+			finishedCondition.notify_one();
+		});
+	};
+
+	size_t running = 0;
+	for (ContractDefinition const* contract: order)
+		if (dependencies[contract].empty())
+		{
+			schedule(contract);
+			++running;
+		}
+
+	while (running > 0)
+	{
+		vector<ContractDefinition const*> justFinished;
+		{
+			unique_lock<mutex> lock(resultsMutex);
+			finishedCondition.wait(lock, [&]() { return !finished.empty(); });
+			swap(justFinished, finished);
+		}
+		for (ContractDefinition const* contract: justFinished)
+		{
+			--running;
+			// Contracts depending on a failed one are not compiled at all.
+			if (failures.count(contract))
+				continue;
+			for (ContractDefinition const* dependent: dependents[contract])
+			{
+				dependencies[dependent].erase(contract);
+				if (dependencies[dependent].empty())
+				{
+					schedule(dependent);
+					++running;
+				}
+			}
+		}
+	}
+
+	m_compilingConcurrently = false;
+
+	// Report what a serial compilation would have reported: the warnings of the contracts
+	// compiled before the first failure and then the failure itself.
+	for (ContractDefinition const* contract: order)
+		if (failures.count(contract))
+			rethrow_exception(failures.at(contract));
+		else if (contract->canBeDeployed())
+			checkContractCodeSize(*contract);
 }
 
 void CompilerStack::compileContract(
@@ -1080,12 +1351,20 @@ void CompilerStack::compileContract(
 		solAssert(false, "Assembly exception for deployed bytecode");
 	}
 
+	if (!m_compilingConcurrently)
+		checkContractCodeSize(_contract);
+
+	_otherCompilers[compiledContract.contract] = compiler;
+}
+
+void CompilerStack::checkContractCodeSize(ContractDefinition const& _contract)
+{
 	// Throw a warning if EIP-170 limits are exceeded:
 	//   If contract creation initialization returns data with length of more than 0x6000 (214 + 213) bytes,
 	//   contract creation fails with an out of gas error.
 	if (
 		m_evmVersion >= langutil::EVMVersion::spuriousDragon() &&
-		compiledContract.runtimeObject.bytecode.size() > 0x6000
+		m_contracts.at(_contract.fullyQualifiedName()).runtimeObject.bytecode.size() > 0x6000
 	)
 		m_errorReporter.warning(
 			5574_error,
@@ -1095,8 +1374,6 @@ void CompilerStack::compileContract(
 			"Consider enabling the optimizer (with a low \"runs\" value!), "
 			"turning off revert strings, or using libraries."
 		);
-
-	_otherCompilers[compiledContract.contract] = compiler;
 }
 
 void CompilerStack::generateIR(ContractDefinition const& _contract)
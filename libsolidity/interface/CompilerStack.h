@@ -175,6 +175,12 @@ public:
 		m_requestedContractNames = _contractNames;
 	}
 
+	/// Sets the maximum number of contracts that are compiled concurrently.
+	/// Contracts only run concurrently if they do not depend on each other and
+	/// the output is identical to a serial compilation. The default of one compiles serially.
+	/// Must be set before compiling.
+	void setParallelism(unsigned _jobs);
+
 	/// Enable experimental generation of Yul IR code.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
@@ -366,6 +372,20 @@ private:
 	/// @returns true if the contract is requested to be compiled.
 	bool isRequestedContract(ContractDefinition const& _contract) const;
 
+	/// @returns the requested contracts together with all the contracts they depend on,
+	/// ordered such that each deployable contract comes after its dependencies.
+	/// This is the order in which a serial compilation visits the contracts.
+	std::vector<ContractDefinition const*> compilationOrder(
+		std::vector<ContractDefinition const*> const& _requestedContracts
+	) const;
+
+	/// Compiles the requested contracts and their dependencies on up to m_parallelism threads.
+	/// A contract is compiled once all its dependencies have been compiled. Contracts that embed
+	/// the code of a common contract are compiled in serial order, since optimising the embedding
+	/// contract modifies the shared assembly of the embedded one.
+	/// Warnings and the first error are reported in the order of a serial compilation.
+	void compileContractsConcurrently(std::vector<ContractDefinition const*> const& _requestedContracts);
+
 	/// Compile a single contract.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
@@ -374,6 +394,9 @@ private:
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
 	);
 
+	/// Warns if the deployed code of the compiled @a _contract exceeds the limit of EIP-170.
+	void checkContractCodeSize(ContractDefinition const& _contract);
+
 	/// Generate Yul IR for a single contract.
 	/// The IR is stored but otherwise unused.
 	void generateIR(ContractDefinition const& _contract);
@@ -438,6 +461,10 @@ private:
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateIR;
 	bool m_generateEwasm;
+	unsigned m_parallelism = 1;
+	/// True while contracts are compiled on multiple threads. Warnings are then reported
+	/// afterwards instead of by compileContract.
+	bool m_compilingConcurrently = false;
 	std::map<std::string, util::h160> m_libraries;
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
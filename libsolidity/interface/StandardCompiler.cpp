@@ -22,6 +22,7 @@
 
 #include <libsolidity/interface/StandardCompiler.h>
 
+#include <libsolidity/interface/Version.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libyul/AssemblyStack.h>
 #include <libyul/Exceptions.h>
@@ -32,10 +33,13 @@
 #include <libsolutil/JSON.h>
 #include <libsolutil/Keccak256.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
 
 #include <algorithm>
+#include <fstream>
 #include <optional>
 
 using namespace std;
@@ -383,7 +387,7 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "remappings"};
+	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "parallelism", "remappings"};
 	return checkKeys(_input, keys, "settings");
 }
 
@@ -557,6 +561,20 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 	return { std::move(settings) };
 }
 
+/// @returns a hash of the result of a read callback, used to detect changes of imported files.
+string readResultHash(ReadCallback::Result const& _result)
+{
+	return util::keccak256((_result.success ? "1" : "0") + _result.responseOrErrorMessage).hex();
+}
+
+bool containsErrors(Json::Value const& _output)
+{
+	for (Json::Value const& error: _output["errors"])
+		if (error["severity"] == "error")
+			return true;
+	return false;
+}
+
 }
 
 std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler::parseInput(Json::Value const& _input)
@@ -700,6 +718,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.parserErrorRecovery = settings["parserErrorRecovery"].asBool();
 	}
 
+	if (settings.isMember("parallelism"))
+	{
+		if (!settings["parallelism"].isUInt() || settings["parallelism"].asUInt() == 0)
+			return formatFatalError("JSONError", "\"settings.parallelism\" must be a positive number.");
+		ret.parallelism = settings["parallelism"].asUInt();
+	}
+
 	if (settings.isMember("evmVersion"))
 	{
 		if (!settings["evmVersion"].isString())
@@ -834,6 +859,7 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.setRemappings(_inputsAndSettings.remappings);
 	compilerStack.setOptimiserSettings(std::move(_inputsAndSettings.optimiserSettings));
 	compilerStack.setRevertStringBehaviour(_inputsAndSettings.revertStrings);
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
 	compilerStack.setLibraries(_inputsAndSettings.libraries);
 	compilerStack.useMetadataLiteralSources(_inputsAndSettings.metadataLiteralSources);
 	compilerStack.setMetadataHash(_inputsAndSettings.metadataHash);
@@ -1180,6 +1206,81 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
+{
+	if (m_cacheDirectory.empty())
+		return compileUncached(_input);
+
+	// Problems with the cache are not reported, they only cause a recompilation.
+	string cacheEntryPath;
+	try
+	{
+		string key = util::keccak256(VersionString + "\n" + util::jsonCompactPrint(_input)).hex();
+		cacheEntryPath = (boost::filesystem::path(m_cacheDirectory) / (key + ".json")).string();
+		if (optional<Json::Value> output = cachedOutput(cacheEntryPath))
+			return std::move(*output);
+	}
+	catch (...)
+	{
+		return compileUncached(_input);
+	}
+
+	// Record all files read during compilation, so that changes of imported files are noticed.
+	Json::Value reads(Json::arrayValue);
+	ReadCallback::Callback readFile = m_readFile;
+	if (readFile)
+		m_readFile = [&](string const& _kind, string const& _path)
+		{
+			ReadCallback::Result result = readFile(_kind, _path);
+			Json::Value read;
+			read["kind"] = _kind;
+			read["path"] = _path;
+			read["hash"] = readResultHash(result);
+			reads.append(std::move(read));
+			return result;
+		};
+	Json::Value output = compileUncached(_input);
+	m_readFile = std::move(readFile);
+
+	if (!containsErrors(output))
+		try
+		{
+			Json::Value entry;
+			entry["reads"] = std::move(reads);
+			entry["output"] = output;
+			// Write to a temporary file first so that other processes never see partial entries.
+			boost::filesystem::path temporaryPath = cacheEntryPath + "." + boost::filesystem::unique_path().string();
+			{
+				ofstream file(temporaryPath.string(), ios::binary);
+				file << util::jsonCompactPrint(entry);
+			}
+			boost::system::error_code error;
+			boost::filesystem::rename(temporaryPath, cacheEntryPath, error);
+			if (error)
+				boost::filesystem::remove(temporaryPath, error);
+		}
+		catch (...)
+		{
+			// The output is still valid, it is only not cached.
+		}
+
+	return output;
+}
+
+optional<Json::Value> StandardCompiler::cachedOutput(string const& _path)
+{
+	Json::Value entry;
+	if (!util::jsonParseStrict(util::readFileAsString(_path), entry) || !entry.isObject())
+		return nullopt;
+	for (Json::Value const& read: entry["reads"])
+		if (
+			!m_readFile ||
+			readResultHash(m_readFile(read["kind"].asString(), read["path"].asString())) != read["hash"].asString()
+		)
+			return nullopt;
+	return entry["output"];
+}
+
+Json::Value StandardCompiler::compileUncached(Json::Value const& _input) noexcept
 {
 	YulStringRepository::reset();
 
@@ -41,8 +41,14 @@ public:
 	/// Creates a new StandardCompiler.
 	/// @param _readFile callback used to read files for import statements. Must return
 	/// and must not emit exceptions.
-	explicit StandardCompiler(ReadCallback::Callback _readFile = ReadCallback::Callback()):
-		m_readFile(std::move(_readFile))
+	/// @param _cacheDirectory directory in which outputs are stored and reused for identical
+	/// inputs, disabled if empty.
+	explicit StandardCompiler(
+		ReadCallback::Callback _readFile = ReadCallback::Callback(),
+		std::string _cacheDirectory = {}
+	):
+		m_readFile(std::move(_readFile)),
+		m_cacheDirectory(std::move(_cacheDirectory))
 	{
 	}
 
@@ -64,6 +70,7 @@ private:
 		langutil::EVMVersion evmVersion;
 		std::vector<CompilerStack::Remapping> remappings;
 		RevertStrings revertStrings = RevertStrings::Default;
+		unsigned parallelism = 1;
 		OptimiserSettings optimiserSettings = OptimiserSettings::minimal();
 		std::map<std::string, util::h160> libraries;
 		bool metadataLiteralSources = false;
@@ -75,10 +82,17 @@ private:
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
+	/// Performs the compilation without consulting the cache.
+	Json::Value compileUncached(Json::Value const& _input) noexcept;
 	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
+	/// @returns the output stored in the cache entry at @a _path if all files read
+	/// during its compilation are still unchanged.
+	std::optional<Json::Value> cachedOutput(std::string const& _path);
+
 	ReadCallback::Callback m_readFile;
+	std::string m_cacheDirectory;
 };
 
 }
@@ -20,7 +20,9 @@
 #include <libsolutil/Assertions.h>
 #include <libsolutil/Exceptions.h>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -33,6 +35,7 @@ DEV_SIMPLE_EXCEPTION(BadLazyInitAccess);
 /**
  * A value that is initialized at some point after construction of the LazyInit. The stored value can only be accessed
  * while calling "init", which initializes the stored value (if it has not already been initialized).
+ * Concurrent calls to "init" are safe: the initialization function is run at most once.
  *
  * @tparam T the type of the stored value; may not be a function, reference, array, or void type; may be const-qualified.
  */
@@ -52,16 +55,21 @@ public:
 	LazyInit& operator=(LazyInit const&) = delete;
 
 	// Move constructor must be overridden to ensure that moved-from object is left empty.
-	constexpr LazyInit(LazyInit&& _other) noexcept:
-		m_value(std::move(_other.m_value))
+	LazyInit(LazyInit&& _other) noexcept:
+		m_value(std::move(_other.m_value)),
+		m_initialized(m_value.has_value())
 	{
 		_other.m_value.reset();
+		_other.m_initialized = false;
 	}
 
 	LazyInit& operator=(LazyInit&& _other) noexcept
 	{
 		this->m_value.swap(_other.m_value);
+		this->m_initialized = this->m_value.has_value();
 		_other.m_value.reset();
+		_other.m_initialized = false;
+		return *this;
 	}
 
 	template<typename F>
@@ -84,11 +92,19 @@ private:
 	template<typename F>
 	void doInit(F&& _fun) const
 	{
+		if (m_initialized.load(std::memory_order_acquire))
+			return;
+		std::lock_guard<std::mutex> lock(m_mutex);
 		if (!m_value.has_value())
+		{
 			m_value.emplace(std::forward<F>(_fun)());
+			m_initialized.store(true, std::memory_order_release);
+		}
 	}
 
 	mutable std::optional<value_type> m_value;
+	mutable std::atomic<bool> m_initialized{false};
+	mutable std::mutex m_mutex;
 };
 
 }
@@ -0,0 +1,78 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Fixed-size pool of worker threads.
+ */
+
+#include <libsolutil/ThreadPool.h>
+
+#include <libsolutil/Assertions.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+ThreadPool::ThreadPool(size_t _threads)
+{
+	if (_threads == 0)
+		_threads = hardwareConcurrency();
+	for (size_t i = 0; i < _threads; ++i)
+		m_workers.emplace_back([this]() { work(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_condition.notify_all();
+	for (thread& worker: m_workers)
+		worker.join();
+}
+
+size_t ThreadPool::hardwareConcurrency()
+{
+	return max<size_t>(thread::hardware_concurrency(), 1);
+}
+
+void ThreadPool::enqueue(function<void()> _task)
+{
+	{
+		lock_guard<mutex> lock(m_mutex);
+		assertThrow(!m_stopping, Exception, "Task submitted to a stopped thread pool.");
+		m_queue.emplace_back(move(_task));
+	}
+	m_condition.notify_one();
+}
+
+void ThreadPool::work()
+{
+	while (true)
+	{
+		function<void()> task;
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+			if (m_queue.empty())
+				return;
+			task = move(m_queue.front());
+			m_queue.pop_front();
+		}
+		task();
+	}
+}
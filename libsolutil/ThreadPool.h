@@ -0,0 +1,88 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Fixed-size pool of worker threads.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Fixed-size pool of worker threads. Tasks are started in submission order, but may
+ * run concurrently and finish in any order.
+ *
+ * Exceptions thrown by a task are captured in the future returned by @a submit and
+ * re-thrown when the result is retrieved. The destructor waits for all queued tasks
+ * to finish.
+ *
+ * Usage:
+ *     ThreadPool pool{4};
+ *     std::future<int> result = pool.submit([]() { return 42; });
+ *     int value = result.get();
+ */
+class ThreadPool
+{
+public:
+	/// Starts @a _threads worker threads. A value of zero selects the number of hardware threads.
+	explicit ThreadPool(size_t _threads);
+	~ThreadPool();
+
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool const&) = delete;
+
+	/// @returns the number of worker threads.
+	size_t size() const { return m_workers.size(); }
+
+	/// Queues @a _task for execution on one of the worker threads.
+	/// @returns a future that provides the result of the task or the exception it threw.
+	template<typename F>
+	std::future<std::invoke_result_t<F>> submit(F&& _task)
+	{
+		using ResultType = std::invoke_result_t<F>;
+		auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<F>(_task));
+		std::future<ResultType> result = task->get_future();
+		enqueue([task]() { (*task)(); });
+		return result;
+	}
+
+	/// @returns the number of concurrent threads supported by the hardware, at least one.
+	static size_t hardwareConcurrency();
+
+private:
+	void enqueue(std::function<void()> _task);
+	void work();
+
+	std::vector<std::thread> m_workers;
+	std::deque<std::function<void()>> m_queue;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	bool m_stopping = false;
+};
+
+}
@@ -63,9 +63,9 @@ unique_ptr<Block> Parser::parse(std::shared_ptr<Scanner> const& _scanner, bool _
 std::map<string, evmasm::Instruction> const& Parser::instructions()
 {
 	// Allowed instructions, lowercase names.
-	static map<string, evmasm::Instruction> s_instructions;
-	if (s_instructions.empty())
+	static map<string, evmasm::Instruction> const s_instructions = []()
 	{
+		map<string, evmasm::Instruction> instructions;
 		for (auto const& instruction: evmasm::c_instructions)
 		{
 			if (
@@ -75,9 +75,10 @@ std::map<string, evmasm::Instruction> const& Parser::instructions()
 				continue;
 			string name = instruction.first;
 			transform(name.begin(), name.end(), name.begin(), [](unsigned char _c) { return tolower(_c); });
-			s_instructions[name] = instruction.second;
+			instructions[name] = instruction.second;
 		}
-	}
+		return instructions;
+	}();
 	return s_instructions;
 }
 
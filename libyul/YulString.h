@@ -22,8 +22,11 @@
 
 #include <boost/noncopyable.hpp>
 
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <functional>
@@ -35,6 +38,9 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+/// Strings are distributed over independently locked shards by their hash, so concurrent
+/// insertions only contend if they fall into the same shard. Lookups by ID do not lock.
+/// Resetting the repository is not thread-safe.
 class YulStringRepository
 {
 public:
@@ -55,27 +61,43 @@ public:
 		if (_string.empty())
 			return { 0, emptyHash() };
 		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
+		Shard& shard = m_shards[h % ShardCount];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		if (2 * (shard.count + 1) > shard.slots.size())
+			grow(shard);
+		size_t mask = shard.slots.size() - 1;
+		size_t index = (h / ShardCount) & mask;
+		for (; shard.slots[index].id != 0; index = (index + 1) & mask)
+			if (shard.slots[index].hash == h && stringAt(shard.slots[index].id) == _string)
+				return Handle{shard.slots[index].id, h};
+		size_t id = m_size.fetch_add(1, std::memory_order_relaxed);
+		chunkFor(id)[id & (ChunkSize - 1)] = _string;
+		shard.slots[index] = Handle{id, h};
+		++shard.count;
 
 		return Handle{id, h};
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
+	/// Does not lock: the string of an ID is never moved or modified once the ID exists.
+	std::string const& idToString(size_t _id) const { return stringAt(_id); }
 
+	/// Hash that processes eight bytes at a time. Bytes are always combined in little-endian
+	/// order, because the hash determines the order of YulStrings and thus the compiler output.
 	static std::uint64_t hash(std::string const& v)
 	{
-		// FNV hash - can be replaced by a better one, e.g. xxhash64
-		std::uint64_t hash = emptyHash();
-		for (char c: v)
+		if (v.empty())
+			return emptyHash();
+		std::uint64_t constexpr multiplier = 0x9e3779b97f4a7c15u;
+		std::uint64_t hash = emptyHash() ^ (v.size() * multiplier);
+		for (size_t pos = 0; pos < v.size(); pos += 8)
 		{
-			hash *= 1099511628211u;
-			hash ^= static_cast<uint64_t>(c);
+			std::uint64_t word = 0;
+			for (size_t i = 0; i < 8 && pos + i < v.size(); ++i)
+				word |= std::uint64_t(static_cast<unsigned char>(v[pos + i])) << (8 * i);
+			hash = (hash ^ word) * multiplier;
+			hash ^= hash >> 29;
 		}
+		hash *= 0xd6e8feb86659fd93u;
+		hash ^= hash >> 32;
 
 		return hash;
 	}
@@ -88,7 +110,7 @@ public:
 	{
 		for (auto const& cb: resetCallbacks())
 			cb();
-		instance() = YulStringRepository{};
+		instance().clear();
 	}
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
@@ -101,11 +123,47 @@ public:
 	};
 
 private:
-	YulStringRepository() = default;
+	/// Number of strings per chunk. Strings are stored in place in the chunks, so short
+	/// strings do not need an allocation of their own. Chunks are never reallocated,
+	/// which keeps references to the stored strings stable.
+	static constexpr size_t ChunkBits = 12;
+	static constexpr size_t ChunkSize = size_t(1) << ChunkBits;
+	static constexpr size_t MaxChunks = size_t(1) << 16;
+	static constexpr size_t ShardCount = 32;
+
+	/// Open-addressing hash table from string hashes to IDs with linear probing.
+	/// Slots with ID zero are empty, the empty string itself is never stored.
+	struct Shard
+	{
+		std::vector<Handle> slots;
+		size_t count = 0;
+		std::mutex mutex;
+	};
+
+	/// Doubles the number of slots in the table of the given shard.
+	static void grow(Shard& _shard)
+	{
+		std::vector<Handle> slots(std::max<size_t>(64, 2 * _shard.slots.size()), Handle{0, 0});
+		size_t mask = slots.size() - 1;
+		for (Handle const& handle: _shard.slots)
+			if (handle.id != 0)
+			{
+				size_t index = (handle.hash / ShardCount) & mask;
+				while (slots[index].id != 0)
+					index = (index + 1) & mask;
+				slots[index] = handle;
+			}
+		_shard.slots = std::move(slots);
+	}
+
+	YulStringRepository() { clear(); }
+	~YulStringRepository()
+	{
+		for (auto& chunk: m_chunks)
+			delete[] chunk.load();
+	}
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
 
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
@@ -113,8 +171,44 @@ private:
 		return callbacks;
 	}
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	std::string const& stringAt(size_t _id) const
+	{
+		return m_chunks[_id >> ChunkBits].load(std::memory_order_acquire)[_id & (ChunkSize - 1)];
+	}
+
+	/// Returns the chunk that stores the string with the given ID, allocating it if needed.
+	std::string* chunkFor(size_t _id)
+	{
+		std::atomic<std::string*>& slot = m_chunks[_id >> ChunkBits];
+		std::string* chunk = slot.load(std::memory_order_acquire);
+		if (!chunk)
+		{
+			auto newChunk = new std::string[ChunkSize];
+			if (slot.compare_exchange_strong(chunk, newChunk, std::memory_order_acq_rel))
+				chunk = newChunk;
+			else
+				delete[] newChunk;
+		}
+		return chunk;
+	}
+
+	/// Removes all strings except for the empty string, which has ID zero.
+	void clear()
+	{
+		for (auto& chunk: m_chunks)
+			delete[] chunk.exchange(nullptr);
+		m_chunks[0] = new std::string[ChunkSize];
+		m_size = 1;
+		for (Shard& shard: m_shards)
+		{
+			shard.slots.clear();
+			shard.count = 0;
+		}
+	}
+
+	std::array<std::atomic<std::string*>, MaxChunks> m_chunks{};
+	std::atomic<size_t> m_size{0};
+	std::array<Shard, ShardCount> m_shards;
 };
 
 /// Wrapper around handles into the YulString repository.
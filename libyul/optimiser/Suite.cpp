@@ -66,13 +66,187 @@
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Keccak256.h>
 
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm_ext/erase.hpp>
 
+#include <mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
+using namespace solidity::langutil;
+
+namespace
+{
+
+/// Moves all source locations inside the code at @a _from to the same relative
+/// position inside the code at @a _to, which has to be a copy of the same text.
+class LocationRelocator: public ASTModifier
+{
+public:
+	LocationRelocator(SourceLocation _from, SourceLocation _to):
+		m_from(move(_from)), m_to(move(_to))
+	{}
+
+	using ASTModifier::operator();
+	void operator()(Literal& _literal) override { relocate(_literal.location); }
+	void operator()(Identifier& _identifier) override { relocate(_identifier.location); }
+	void operator()(FunctionCall& _funCall) override
+	{
+		relocate(_funCall.location);
+		relocate(_funCall.functionName.location);
+		ASTModifier::operator()(_funCall);
+	}
+	void operator()(ExpressionStatement& _statement) override
+	{
+		relocate(_statement.location);
+		ASTModifier::operator()(_statement);
+	}
+	void operator()(Assignment& _assignment) override
+	{
+		relocate(_assignment.location);
+		ASTModifier::operator()(_assignment);
+	}
+	void operator()(VariableDeclaration& _varDecl) override
+	{
+		relocate(_varDecl.location);
+		for (TypedName& variable: _varDecl.variables)
+			relocate(variable.location);
+		ASTModifier::operator()(_varDecl);
+	}
+	void operator()(If& _if) override
+	{
+		relocate(_if.location);
+		ASTModifier::operator()(_if);
+	}
+	void operator()(Switch& _switch) override
+	{
+		relocate(_switch.location);
+		for (Case& _case: _switch.cases)
+			relocate(_case.location);
+		ASTModifier::operator()(_switch);
+	}
+	void operator()(FunctionDefinition& _funDef) override
+	{
+		relocate(_funDef.location);
+		for (TypedName& parameter: _funDef.parameters)
+			relocate(parameter.location);
+		for (TypedName& returnVariable: _funDef.returnVariables)
+			relocate(returnVariable.location);
+		ASTModifier::operator()(_funDef);
+	}
+	void operator()(ForLoop& _for) override
+	{
+		relocate(_for.location);
+		ASTModifier::operator()(_for);
+	}
+	void operator()(Break& _break) override { relocate(_break.location); }
+	void operator()(Continue& _continue) override { relocate(_continue.location); }
+	void operator()(Leave& _leave) override { relocate(_leave.location); }
+	void operator()(Block& _block) override
+	{
+		relocate(_block.location);
+		ASTModifier::operator()(_block);
+	}
+
+private:
+	void relocate(SourceLocation& _location) const
+	{
+		if (!m_from.contains(_location))
+			return;
+		_location.start += m_to.start - m_from.start;
+		_location.end += m_to.start - m_from.start;
+		_location.source = m_to.source;
+	}
+
+	SourceLocation m_from;
+	SourceLocation m_to;
+};
+
+/**
+ * Results of earlier optimiser runs, keyed by the source text of the code and the optimiser
+ * settings. Code that is optimised repeatedly with the same settings, for example the object
+ * of a contract that is created by several other contracts or the same utility functions in
+ * multiple contracts, is only optimised once per compilation.
+ */
+class OptimisedCodeCache
+{
+public:
+	static OptimisedCodeCache& instance()
+	{
+		static OptimisedCodeCache cache;
+		static YulStringRepository::ResetCallback callback{[&] { cache.clear(); }};
+		return cache;
+	}
+
+	/// @returns a copy of the optimised code stored for @a _key, with all source locations moved
+	/// from the originally optimised code to @a _location.
+	optional<Block> find(util::h256 const& _key, SourceLocation const& _location) const
+	{
+		Entry entry;
+		{
+			lock_guard<mutex> lock(m_mutex);
+			auto it = m_entries.find(_key);
+			if (it == m_entries.end())
+				return nullopt;
+			entry = it->second;
+		}
+		Block code = std::get<Block>(ASTCopier{}(*entry.code));
+		LocationRelocator{entry.location, _location}(code);
+		return code;
+	}
+
+	void store(util::h256 const& _key, SourceLocation const& _location, Block const& _code)
+	{
+		auto code = make_shared<Block const>(std::get<Block>(ASTCopier{}(_code)));
+		lock_guard<mutex> lock(m_mutex);
+		m_entries.emplace(_key, Entry{_location, move(code)});
+	}
+
+private:
+	struct Entry
+	{
+		/// Location of the code the result was computed from.
+		SourceLocation location;
+		shared_ptr<Block const> code;
+	};
+
+	void clear()
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_entries.clear();
+	}
+
+	mutable mutex m_mutex;
+	map<util::h256, Entry> m_entries;
+};
+
+/// @returns the key under which the result of optimising @a _code with the given settings is cached
+/// or nullopt if the code does not have source text and cannot be cached.
+optional<util::h256> optimisedCodeCacheKey(
+	Dialect const& _dialect,
+	Block const& _code,
+	bool _optimizeStackAllocation,
+	string const& _optimisationSequence,
+	set<YulString> const& _reservedIdentifiers
+)
+{
+	if (!_code.location.hasText())
+		return nullopt;
+
+	// Dialects are singletons that live at least as long as the cache.
+	string key = to_string(reinterpret_cast<uintptr_t>(&_dialect));
+	key += _optimizeStackAllocation ? "+" : "-";
+	key += _optimisationSequence + ":";
+	for (YulString identifier: _reservedIdentifiers)
+		key += identifier.str() + ",";
+	key += ":" + _code.location.text();
+	return util::keccak256(key);
+}
+
+}
 
 void OptimiserSuite::run(
 	Dialect const& _dialect,
@@ -86,35 +260,52 @@ void OptimiserSuite::run(
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
 	reservedIdentifiers += _dialect.fixedFunctionNames();
 
-	*_object.code = std::get<Block>(Disambiguator(
-		_dialect,
-		*_object.analysisInfo,
-		reservedIdentifiers
-	)(*_object.code));
-	Block& ast = *_object.code;
-
-	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
-
-	// Some steps depend on properties ensured by FunctionHoister, FunctionGrouper and
-	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
-	suite.runSequence("fgo", ast);
-
-	// Now the user-supplied part
-	suite.runSequence(_optimisationSequence, ast);
-
-	// This is a tuning parameter, but actually just prevents infinite loops.
-	size_t stackCompressorMaxIterations = 16;
-	suite.runSequence("g", ast);
-
-	// We ignore the return value because we will get a much better error
-	// message once we perform code generation.
-	StackCompressor::run(
+	SourceLocation const location = _object.code->location;
+	optional<util::h256> cacheKey = optimisedCodeCacheKey(
 		_dialect,
-		_object,
+		*_object.code,
 		_optimizeStackAllocation,
-		stackCompressorMaxIterations
+		_optimisationSequence,
+		reservedIdentifiers
 	);
-	suite.runSequence("fDnTOc g", ast);
+	if (optional<Block> cachedCode = cacheKey ? OptimisedCodeCache::instance().find(*cacheKey, location) : nullopt)
+		*_object.code = move(*cachedCode);
+	else
+	{
+		*_object.code = std::get<Block>(Disambiguator(
+			_dialect,
+			*_object.analysisInfo,
+			reservedIdentifiers
+		)(*_object.code));
+		Block& ast = *_object.code;
+
+		OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
+
+		// Some steps depend on properties ensured by FunctionHoister, FunctionGrouper and
+		// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
+		suite.runSequence("fgo", ast);
+
+		// Now the user-supplied part
+		suite.runSequence(_optimisationSequence, ast);
+
+		// This is a tuning parameter, but actually just prevents infinite loops.
+		size_t stackCompressorMaxIterations = 16;
+		suite.runSequence("g", ast);
+
+		// We ignore the return value because we will get a much better error
+		// message once we perform code generation.
+		StackCompressor::run(
+			_dialect,
+			_object,
+			_optimizeStackAllocation,
+			stackCompressorMaxIterations
+		);
+		suite.runSequence("fDnTOc g", ast);
+
+		if (cacheKey)
+			OptimisedCodeCache::instance().store(*cacheKey, location, ast);
+	}
+	Block& ast = *_object.code;
 
 	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&_dialect))
 	{
@@ -128,6 +319,7 @@ void OptimiserSuite::run(
 		if (ast.statements.size() > 1 && std::get<Block>(ast.statements.front()).statements.empty())
 			ast.statements.erase(ast.statements.begin());
 	}
+	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
 	VarNameCleaner::run(suite.m_context, ast);
 
 	*_object.analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
@@ -155,38 +347,36 @@ map<string, unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static map<string, unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
-			BlockFlattener,
-			CircularReferencesPruner,
-			CommonSubexpressionEliminator,
-			ConditionalSimplifier,
-			ConditionalUnsimplifier,
-			ControlFlowSimplifier,
-			DeadCodeEliminator,
-			EquivalentFunctionCombiner,
-			ExpressionInliner,
-			ExpressionJoiner,
-			ExpressionSimplifier,
-			ExpressionSplitter,
-			ForLoopConditionIntoBody,
-			ForLoopConditionOutOfBody,
-			ForLoopInitRewriter,
-			FullInliner,
-			FunctionGrouper,
-			FunctionHoister,
-			LiteralRematerialiser,
-			LoadResolver,
-			LoopInvariantCodeMotion,
-			RedundantAssignEliminator,
-			Rematerialiser,
-			SSAReverser,
-			SSATransform,
-			StructuralSimplifier,
-			UnusedPruner,
-			VarDeclInitializer
-		>();
+	static map<string, unique_ptr<OptimiserStep>> const instance = optimiserStepCollection<
+		BlockFlattener,
+		CircularReferencesPruner,
+		CommonSubexpressionEliminator,
+		ConditionalSimplifier,
+		ConditionalUnsimplifier,
+		ControlFlowSimplifier,
+		DeadCodeEliminator,
+		EquivalentFunctionCombiner,
+		ExpressionInliner,
+		ExpressionJoiner,
+		ExpressionSimplifier,
+		ExpressionSplitter,
+		ForLoopConditionIntoBody,
+		ForLoopConditionOutOfBody,
+		ForLoopInitRewriter,
+		FullInliner,
+		FunctionGrouper,
+		FunctionHoister,
+		LiteralRematerialiser,
+		LoadResolver,
+		LoopInvariantCodeMotion,
+		RedundantAssignEliminator,
+		Rematerialiser,
+		SSAReverser,
+		SSATransform,
+		StructuralSimplifier,
+		UnusedPruner,
+		VarDeclInitializer
+	>();
 	// Does not include VarNameCleaner because it destroys the property of unique names.
 	return instance;
 }
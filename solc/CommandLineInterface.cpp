@@ -118,6 +118,7 @@ static string const g_strAstJson = "ast-json";
 static string const g_strAstCompactJson = "ast-compact-json";
 static string const g_strBinary = "bin";
 static string const g_strBinaryRuntime = "bin-runtime";
+static string const g_strCacheDir = "cache-dir";
 static string const g_strCombinedJson = "combined-json";
 static string const g_strCompactJSON = "compact-format";
 static string const g_strContracts = "contracts";
@@ -131,6 +132,7 @@ static string const g_strHelp = "help";
 static string const g_strImportAst = "import-ast";
 static string const g_strInputFile = "input-file";
 static string const g_strInterface = "interface";
+static string const g_strJobs = "jobs";
 static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
 static string const g_strIR = "ir";
@@ -193,6 +195,7 @@ static string const g_argAstCompactJson = g_strAstCompactJson;
 static string const g_argAstJson = g_strAstJson;
 static string const g_argBinary = g_strBinary;
 static string const g_argBinaryRuntime = g_strBinaryRuntime;
+static string const g_argCacheDir = g_strCacheDir;
 static string const g_argCombinedJson = g_strCombinedJson;
 static string const g_argCompactJSON = g_strCompactJSON;
 static string const g_argErrorRecovery = g_strErrorRecovery;
@@ -200,6 +203,7 @@ static string const g_argGas = g_strGas;
 static string const g_argHelp = g_strHelp;
 static string const g_argImportAst = g_strImportAst;
 static string const g_argInputFile = g_strInputFile;
+static string const g_argJobs = g_strJobs;
 static string const g_argYul = g_strYul;
 static string const g_argIR = g_strIR;
 static string const g_argIROptimized = g_strIROptimized;
@@ -797,6 +801,11 @@ General Information)").c_str(),
 			po::value<string>()->value_name(boost::join(g_revertStringsArgs, ",")),
 			"Strip revert (and require) reason strings or add additional debugging information."
 		)
+		(
+			(g_argJobs + ",j").c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Compile up to n contracts concurrently. The output does not depend on this setting."
+		)
 	;
 	desc.add(outputOptions);
 
@@ -807,6 +816,12 @@ General Information)").c_str(),
 			"Switch to Standard JSON input / output mode, ignoring all options. "
 			"It reads from standard input, if no input file was given, otherwise it reads from the provided input file. The result will be written to standard output."
 		)
+		(
+			g_argCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			("Store the results of --" + g_argStandardJSON + " in the given directory and reuse them "
+			"for identical inputs whose imported files did not change.").c_str()
+		)
 		(
 			g_argLink.c_str(),
 			("Switch to linker mode, ignoring all options apart from --" + g_argLibraries + " "
@@ -1034,6 +1049,12 @@ General Information)").c_str(),
 		m_revertStrings = *revertStrings;
 	}
 
+	if (m_args[g_argJobs].as<unsigned>() == 0)
+	{
+		serr() << "Invalid option for --" << g_argJobs << ": the number of jobs must be positive." << endl;
+		return false;
+	}
+
 	if (m_args.count(g_argCombinedJson))
 	{
 		vector<string> requests;
@@ -1164,7 +1185,21 @@ bool CommandLineInterface::processInput()
 			input = readStandardInput();
 		else
 			input = readFileAsString(jsonFile);
-		StandardCompiler compiler(fileReader);
+		string cacheDirectory;
+		if (m_args.count(g_argCacheDir))
+		{
+			cacheDirectory = m_args[g_argCacheDir].as<string>();
+			try
+			{
+				boost::filesystem::create_directories(cacheDirectory);
+			}
+			catch (boost::filesystem::filesystem_error const& _exception)
+			{
+				serr() << "Invalid option for --" << g_argCacheDir << ": " << _exception.what() << endl;
+				return false;
+			}
+		}
+		StandardCompiler compiler(fileReader, cacheDirectory);
 		sout() << compiler.compile(std::move(input)) << endl;
 		return true;
 	}
@@ -1352,6 +1387,7 @@ bool CommandLineInterface::processInput()
 			m_compiler->setLibraries(m_libraries);
 		m_compiler->setEVMVersion(m_evmVersion);
 		m_compiler->setRevertStringBehaviour(m_revertStrings);
+		m_compiler->setParallelism(m_args[g_argJobs].as<unsigned>());
 		// TODO: Perhaps we should not compile unless requested
 
 		m_compiler->enableIRGeneration(m_args.count(g_argIR) || m_args.count(g_argIROptimized));
@@ -26,8 +26,12 @@
 #include <libsolidity/interface/Version.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
 #include <test/Metadata.h>
 
+#include <boost/filesystem.hpp>
+
+#include <fstream>
 #include <set>
 
 using namespace std;
@@ -93,6 +97,22 @@ Json::Value compile(string _input)
 	return ret;
 }
 
+Json::Value compileWithParallelism(string const& _sourceCode, unsigned _jobs, bool _requestIR = true)
+{
+	Json::Value input;
+	input["language"] = "Solidity";
+	input["sources"]["fileA"]["content"] = _sourceCode;
+	input["settings"]["parallelism"] = _jobs;
+	input["settings"]["optimizer"]["enabled"] = true;
+	input["settings"]["outputSelection"]["*"]["*"].append("evm.bytecode");
+	input["settings"]["outputSelection"]["*"]["*"].append("evm.deployedBytecode");
+	input["settings"]["outputSelection"]["*"]["*"].append("evm.assembly");
+	input["settings"]["outputSelection"]["*"]["*"].append("metadata");
+	if (_requestIR)
+		input["settings"]["outputSelection"]["*"]["*"].append("irOptimized");
+	return compile(util::jsonCompactPrint(input));
+}
+
 } // end anonymous namespace
 
 BOOST_AUTO_TEST_SUITE(StandardCompiler)
@@ -327,6 +347,81 @@ BOOST_AUTO_TEST_CASE(optimizer_runs_not_an_unsigned_number)
 	BOOST_CHECK(containsError(result, "JSONError", "The \"runs\" setting must be an unsigned number."));
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_not_positive)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"parallelism": 0
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be a positive number."));
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_same_output)
+{
+	string sourceCode = R"(
+		contract A { function f() public pure returns (uint) { return 1; } }
+		contract B is A { function g() public { new A(); } }
+		contract C { function h() public pure returns (bytes memory) { return type(B).creationCode; } }
+		contract D { function i() public { new A(); } }
+	)";
+	Json::Value serial = compileWithParallelism(sourceCode, 1);
+	BOOST_CHECK(containsAtMostWarnings(serial));
+	BOOST_REQUIRE(serial["contracts"]["fileA"].size() == 4);
+	for (unsigned jobs: {2u, 4u})
+		BOOST_CHECK(util::jsonCompactPrint(compileWithParallelism(sourceCode, jobs)) == util::jsonCompactPrint(serial));
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_same_output_libraries)
+{
+	// The code of X is embedded into F and H through the internal library function,
+	// which is not recorded as a dependency of F or H.
+	// The IR generator does not support libraries yet, so no IR is requested.
+	string sourceCode = R"(
+		library L { function j() external pure returns (uint) { return 7; } }
+		contract E { function k() public pure returns (uint) { return L.j(); } }
+		contract X { function x() public pure returns (uint) { return 2; } }
+		library M { function make() internal returns (address) { return address(new X()); } }
+		contract F { function m() public returns (address) { return M.make(); } }
+		contract G { function n() public returns (address) { return address(new X()); } }
+		contract H { function o() public returns (address) { return M.make(); } }
+	)";
+	Json::Value serial = compileWithParallelism(sourceCode, 1, false);
+	BOOST_CHECK(containsAtMostWarnings(serial));
+	BOOST_REQUIRE(serial["contracts"]["fileA"].size() == 7);
+	for (unsigned jobs: {2u, 4u})
+		BOOST_CHECK(util::jsonCompactPrint(compileWithParallelism(sourceCode, jobs, false)) == util::jsonCompactPrint(serial));
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_same_error)
+{
+	string sourceCode = R"(
+		contract A { function f() public pure returns (uint) { return 1; } }
+		contract K {
+			function f(
+				uint a, uint b, uint c, uint d, uint e, uint f1, uint g, uint h, uint i,
+				uint j, uint k, uint l, uint m, uint n, uint o, uint p, uint q
+			) public pure returns (uint) {
+				return a + b + c + d + e + f1 + g + h + i + j + k + l + m + n + o + p + q;
+			}
+		}
+		contract Z { function z() public returns (address) { return address(new A()); } }
+	)";
+	Json::Value serial = compileWithParallelism(sourceCode, 1);
+	BOOST_CHECK(!containsAtMostWarnings(serial));
+	for (unsigned jobs: {2u, 4u})
+		BOOST_CHECK(util::jsonCompactPrint(compileWithParallelism(sourceCode, jobs)) == util::jsonCompactPrint(serial));
+}
+
 BOOST_AUTO_TEST_CASE(basic_compilation)
 {
 	char const* input = R"(
@@ -1411,6 +1506,46 @@ BOOST_AUTO_TEST_CASE(standard_output_selection_wildcard_multiple_sources)
 	BOOST_REQUIRE(result["sources"]["B"].isObject());
 }
 
+BOOST_AUTO_TEST_CASE(cache_directory)
+{
+	boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	boost::filesystem::create_directories(cacheDirectory);
+	map<string, string> files{{"B", "pragma solidity >=0.0; contract B { function f() public pure returns (uint) { return 1; } }"}};
+	ReadCallback::Callback readFile = [&](string const&, string const& _path)
+	{
+		if (files.count(_path))
+			return ReadCallback::Result{true, files.at(_path)};
+		return ReadCallback::Result{false, "File not found."};
+	};
+	Json::Value input;
+	input["language"] = "Solidity";
+	input["sources"]["A"]["content"] = "pragma solidity >=0.0; import \"B\"; contract A is B {}";
+	input["settings"]["outputSelection"]["*"]["*"].append("evm.bytecode.object");
+
+	Json::Value result = solidity::frontend::StandardCompiler(readFile, cacheDirectory.string()).compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	vector<boost::filesystem::path> entries{
+		boost::filesystem::directory_iterator(cacheDirectory),
+		boost::filesystem::directory_iterator()
+	};
+	BOOST_REQUIRE_EQUAL(entries.size(), 1);
+
+	// Mark the stored output to see whether it is used.
+	Json::Value entry;
+	BOOST_REQUIRE(util::jsonParseStrict(util::readFileAsString(entries.front().string()), entry));
+	entry["output"]["cached"] = true;
+	ofstream(entries.front().string()) << util::jsonCompactPrint(entry);
+	BOOST_CHECK(solidity::frontend::StandardCompiler(readFile, cacheDirectory.string()).compile(input)["cached"] == true);
+
+	// Changes of imported files are noticed.
+	files["B"] = "pragma solidity >=0.0; contract B { function f() public pure returns (uint) { return 2; } }";
+	Json::Value changedResult = solidity::frontend::StandardCompiler(readFile, cacheDirectory.string()).compile(input);
+	BOOST_CHECK(!changedResult.isMember("cached"));
+	BOOST_CHECK(changedResult["contracts"]["A"]["A"] != result["contracts"]["A"]["A"]);
+
+	boost::filesystem::remove_all(cacheDirectory);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -17,9 +17,9 @@ contract C {
 // optimize-yul: true
 // ----
 // creation:
-//   codeDepositCost: 603000
-//   executionCost: 638
-//   totalCost: 603638
+//   codeDepositCost: 613600
+//   executionCost: 645
+//   totalCost: 614245
 // external:
 //   a(): 1029
 //   b(uint256): 2084
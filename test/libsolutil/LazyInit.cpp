@@ -19,7 +19,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace solidity::util::test
 {
@@ -113,6 +116,39 @@ BOOST_AUTO_TEST_CASE(move_constructed_has_same_value_as_original)
 	BOOST_CHECK_EQUAL(valueOf(std::move(moveConstructed)), 12);
 }
 
+BOOST_AUTO_TEST_CASE(move_assigned_has_same_value_as_original)
+{
+	LazyInit<int> original;
+	original.init([]{ return 12; });
+
+	LazyInit<int> moveAssigned;
+	moveAssigned = std::move(original);
+	BOOST_CHECK_EQUAL(valueOf(std::move(moveAssigned)), 12);
+	assertEmpty(std::move(original));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_init_runs_once)
+{
+	LazyInit<int> lazyInit;
+	std::atomic<int> initCalls{0};
+
+	std::vector<std::thread> threads;
+	std::vector<int> values(8);
+	for (size_t i = 0; i < values.size(); ++i)
+		threads.emplace_back([&, i]{
+			values[i] = lazyInit.init([&]{
+				++initCalls;
+				return 12;
+			});
+		});
+	for (std::thread& thread: threads)
+		thread.join();
+
+	BOOST_CHECK_EQUAL(initCalls, 1);
+	for (int value: values)
+		BOOST_CHECK_EQUAL(value, 12);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,77 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the thread pool.
+ */
+
+#include <libsolutil/ThreadPool.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(zero_selects_hardware_concurrency)
+{
+	ThreadPool pool{0};
+	BOOST_CHECK_EQUAL(pool.size(), ThreadPool::hardwareConcurrency());
+	BOOST_CHECK(pool.size() >= 1);
+}
+
+BOOST_AUTO_TEST_CASE(results)
+{
+	ThreadPool pool{4};
+	vector<future<size_t>> results;
+	for (size_t i = 0; i < 100; ++i)
+		results.emplace_back(pool.submit([i]() { return i * i; }));
+	for (size_t i = 0; i < results.size(); ++i)
+		BOOST_CHECK_EQUAL(results[i].get(), i * i);
+}
+
+BOOST_AUTO_TEST_CASE(exception_is_propagated)
+{
+	ThreadPool pool{2};
+	future<int> failing = pool.submit([]() -> int { throw runtime_error("task failed"); });
+	future<int> succeeding = pool.submit([]() { return 7; });
+	BOOST_CHECK_THROW(failing.get(), runtime_error);
+	BOOST_CHECK_EQUAL(succeeding.get(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(destructor_drains_queue)
+{
+	atomic<size_t> executed{0};
+	{
+		ThreadPool pool{2};
+		for (size_t i = 0; i < 50; ++i)
+			pool.submit([&]() { ++executed; });
+	}
+	BOOST_CHECK_EQUAL(executed, 50);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,77 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the optimiser suite.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/AsmData.h>
+#include <libyul/AssemblyStack.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/Object.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulOptimiserSuite)
+
+BOOST_AUTO_TEST_CASE(identical_code_is_optimised_identically)
+{
+	string const code = "{ let x := calldataload(0) let y := add(x, 1) sstore(x, y) }";
+	string const source =
+		"object \"A\" { code " + code +
+		" object \"B\" { code " + code + " }"
+		" object \"C\" { code " + code + " } }";
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		solidity::frontend::OptimiserSettings::full()
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("source", source));
+	stack.optimize();
+
+	Object const& object = *stack.parserResult();
+	BOOST_REQUIRE_EQUAL(object.subObjects.size(), 2);
+	string const optimised = AsmPrinter{}(*object.code);
+	size_t codeStart = source.find(code);
+	for (auto const& subNode: object.subObjects)
+	{
+		auto const* subObject = dynamic_cast<Object const*>(subNode.get());
+		BOOST_REQUIRE(subObject);
+		BOOST_CHECK_EQUAL(AsmPrinter{}(*subObject->code), optimised);
+
+		// Source locations refer to the code of the respective object.
+		codeStart = source.find(code, codeStart + 1);
+		SourceLocation const& location = subObject->code->location;
+		BOOST_CHECK_EQUAL(location.start, int(codeStart));
+		BOOST_CHECK_EQUAL(location.end, int(codeStart + code.size()));
+		for (Statement const& statement: subObject->code->statements)
+			BOOST_CHECK(location.contains(locationOf(statement)));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
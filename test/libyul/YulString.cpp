@@ -0,0 +1,89 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the YulString repository.
+ */
+
+#include <libyul/YulString.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(handle_size)
+{
+	BOOST_CHECK_EQUAL(sizeof(YulString), sizeof(size_t) + sizeof(uint64_t));
+}
+
+BOOST_AUTO_TEST_CASE(equal_strings_are_equal)
+{
+	BOOST_CHECK(YulString{"abc"} == YulString{"abc"});
+	BOOST_CHECK(YulString{"abc"} != YulString{"abd"});
+	BOOST_CHECK(YulString{""}.empty());
+	BOOST_CHECK(YulString{}.empty());
+	BOOST_CHECK_EQUAL(YulString{"abc"}.str(), "abc");
+}
+
+BOOST_AUTO_TEST_CASE(hash_is_platform_independent)
+{
+	// The hash determines the order of YulStrings and thus the compiler output.
+	BOOST_CHECK_EQUAL(YulStringRepository::hash(""), YulStringRepository::emptyHash());
+	BOOST_CHECK_EQUAL(YulStringRepository::hash("abc"), 10356890399226129376u);
+	BOOST_CHECK_EQUAL(YulStringRepository::hash("abcdefgh"), 7971133318645617937u);
+	BOOST_CHECK_EQUAL(YulStringRepository::hash("abi_decode_tuple_t_uint256"), 15145475556627329794u);
+	BOOST_CHECK(YulStringRepository::hash("abcdefgh") != YulStringRepository::hash(string("abcdefgh\0", 9)));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_insertions)
+{
+	size_t const threadCount = 8;
+	size_t const stringCount = 5000;
+	vector<vector<YulString>> results(threadCount);
+	vector<thread> threads;
+	for (size_t t = 0; t < threadCount; ++t)
+		threads.emplace_back([&, t]() {
+			for (size_t i = 0; i < stringCount; ++i)
+				results[t].emplace_back("concurrent_" + to_string((i * (t + 1)) % stringCount));
+		});
+	for (auto& t: threads)
+		t.join();
+
+	vector<YulString> expected;
+	for (size_t i = 0; i < stringCount; ++i)
+		expected.emplace_back("concurrent_" + to_string(i));
+	for (size_t t = 0; t < threadCount; ++t)
+		for (size_t i = 0; i < stringCount; ++i)
+		{
+			YulString const& s = results[t][i];
+			BOOST_REQUIRE(s == expected[(i * (t + 1)) % stringCount]);
+			BOOST_REQUIRE_EQUAL(s.str(), expected[(i * (t + 1)) % stringCount].str());
+		}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}